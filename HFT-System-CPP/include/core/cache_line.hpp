@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+
+namespace hft {
+namespace core {
+
+/**
+ * Cache geometry constants
+ * Pinned per architecture rather than taken from
+ * std::hardware_destructive_interference_size: that value follows -mtune,
+ * which makes a header-defined constant an ABI hazard (and GCC warns on
+ * every use). Cache lines are 128 bytes on Apple M-series and POWER,
+ * 64 everywhere else we target
+ */
+#if defined(__aarch64__) || defined(__powerpc64__)
+inline constexpr size_t CACHE_LINE_SIZE = 128;
+#else
+inline constexpr size_t CACHE_LINE_SIZE = 64;
+#endif
+
+// Separation needed to defeat the adjacent-line (L2 spatial) prefetcher,
+// which drags the sibling line along with every miss
+inline constexpr size_t FALSE_SHARING_RANGE = 2 * CACHE_LINE_SIZE;
+
+} // namespace core
+} // namespace hft
@@ -1,35 +1,40 @@
-#pragma once
-
-#include <string>
-#include <unordered_map>
-#include <memory>
-#include <stdexcept>
-
-namespace hft {
-namespace core {
-
-/**
- * Configuration manager
- * Loads and manages system configuration
- */
-class Config {
-public:
-    static Config& instance() {
-        static Config instance;
-        return instance;
-    }
-
-    void load(const std::string& config_file);
-
-    std::string getString(const std::string& key, const std::string& default_val = "") const;
-    int getInt(const std::string& key, int default_val = 0) const;
-    double getDouble(const std::string& key, double default_val = 0.0) const;
-    bool getBool(const std::string& key, bool default_val = false) const;
-
-private:
-    Config() = default;
-    std::unordered_map<std::string, std::string> config_map_;
-};
-
-} // namespace core
-} // namespace hft
+#pragma once
+
+#include "transparent_hash.hpp"
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <memory>
+#include <stdexcept>
+
+namespace hft {
+namespace core {
+
+/**
+ * Configuration manager
+ * Loads and manages system configuration
+ */
+class Config {
+public:
+    static Config& instance() {
+        static Config instance;
+        return instance;
+    }
+
+    void load(const std::string& config_file);
+
+    // Keys are looked up heterogeneously: string literals and string_views
+    // never materialize a temporary std::string
+    std::string getString(std::string_view key, std::string_view default_val = "") const;
+    int getInt(std::string_view key, int default_val = 0) const;
+    double getDouble(std::string_view key, double default_val = 0.0) const;
+    bool getBool(std::string_view key, bool default_val = false) const;
+
+private:
+    Config() = default;
+    std::unordered_map<std::string, std::string,
+                       TransparentStringHash, std::equal_to<>> config_map_;
+};
+
+} // namespace core
+} // namespace hft
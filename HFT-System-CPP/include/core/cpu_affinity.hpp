@@ -0,0 +1,39 @@
+#pragma once
+
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace hft {
+namespace core {
+
+/**
+ * Pin a thread to a single CPU core
+ * Prevents the scheduler from migrating hot threads across cores,
+ * which would cold-start their L1/L2 working set on every reschedule
+ * Returns false if pinning is unsupported or fails
+ */
+inline bool pinThreadToCore(std::thread& thread, int core) {
+    #if defined(__linux__)
+    if (core < 0) {
+        return false;
+    }
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(core, &cpuset);
+
+    return pthread_setaffinity_np(thread.native_handle(),
+                                  sizeof(cpu_set_t), &cpuset) == 0;
+    #else
+    (void)thread;
+    (void)core;
+    return false;
+    #endif
+}
+
+} // namespace core
+} // namespace hft
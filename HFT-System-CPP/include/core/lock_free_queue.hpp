@@ -1,81 +1,105 @@
-#pragma once
-
-#include <atomic>
-#include <array>
-#include <optional>
-
-namespace hft {
-namespace core {
-
-/**
- * Lock-free SPSC (Single Producer Single Consumer) queue
- * Optimized for low-latency message passing
- */
-template<typename T, size_t Size = 65536>
-class LockFreeQueue {
-public:
-    LockFreeQueue() : head_(0), tail_(0) {
-        static_assert((Size & (Size - 1)) == 0, "Size must be power of 2");
-    }
-
-    // Non-copyable
-    LockFreeQueue(const LockFreeQueue&) = delete;
-    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
-
-    bool push(const T& item) {
-        size_t current_tail = tail_.load(std::memory_order_relaxed);
-        size_t next_tail = (current_tail + 1) & (Size - 1);
-
-        if (next_tail == head_.load(std::memory_order_acquire)) {
-            return false; // Queue is full
-        }
-
-        buffer_[current_tail] = item;
-        tail_.store(next_tail, std::memory_order_release);
-        return true;
-    }
-
-    bool push(T&& item) {
-        size_t current_tail = tail_.load(std::memory_order_relaxed);
-        size_t next_tail = (current_tail + 1) & (Size - 1);
-
-        if (next_tail == head_.load(std::memory_order_acquire)) {
-            return false; // Queue is full
-        }
-
-        buffer_[current_tail] = std::move(item);
-        tail_.store(next_tail, std::memory_order_release);
-        return true;
-    }
-
-    std::optional<T> pop() {
-        size_t current_head = head_.load(std::memory_order_relaxed);
-
-        if (current_head == tail_.load(std::memory_order_acquire)) {
-            return std::nullopt; // Queue is empty
-        }
-
-        T item = std::move(buffer_[current_head]);
-        head_.store((current_head + 1) & (Size - 1), std::memory_order_release);
-        return item;
-    }
-
-    bool empty() const {
-        return head_.load(std::memory_order_acquire) ==
-               tail_.load(std::memory_order_acquire);
-    }
-
-    size_t size() const {
-        size_t h = head_.load(std::memory_order_acquire);
-        size_t t = tail_.load(std::memory_order_acquire);
-        return (t >= h) ? (t - h) : (Size - h + t);
-    }
-
-private:
-    alignas(64) std::atomic<size_t> head_;
-    alignas(64) std::atomic<size_t> tail_;
-    std::array<T, Size> buffer_;
-};
-
-} // namespace core
-} // namespace hft
+#pragma once
+
+#include "cache_line.hpp"
+#include <atomic>
+#include <array>
+#include <optional>
+
+namespace hft {
+namespace core {
+
+/**
+ * Lock-free SPSC (Single Producer Single Consumer) queue
+ * Optimized for low-latency message passing
+ */
+template<typename T, size_t Size = 65536>
+class LockFreeQueue {
+public:
+    LockFreeQueue() : head_(0), tail_(0) {
+        static_assert((Size & (Size - 1)) == 0, "Size must be power of 2");
+    }
+
+    // Non-copyable
+    LockFreeQueue(const LockFreeQueue&) = delete;
+    LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+    bool push(const T& item) {
+        size_t current_tail = tail_.load(std::memory_order_relaxed);
+        size_t next_tail = (current_tail + 1) & (Size - 1);
+
+        if (next_tail == head_.load(std::memory_order_acquire)) {
+            return false; // Queue is full
+        }
+
+        buffer_[current_tail] = item;
+        tail_.store(next_tail, std::memory_order_release);
+        return true;
+    }
+
+    bool push(T&& item) {
+        size_t current_tail = tail_.load(std::memory_order_relaxed);
+        size_t next_tail = (current_tail + 1) & (Size - 1);
+
+        if (next_tail == head_.load(std::memory_order_acquire)) {
+            return false; // Queue is full
+        }
+
+        buffer_[current_tail] = std::move(item);
+        tail_.store(next_tail, std::memory_order_release);
+        return true;
+    }
+
+    std::optional<T> pop() {
+        size_t current_head = head_.load(std::memory_order_relaxed);
+
+        if (current_head == tail_.load(std::memory_order_acquire)) {
+            return std::nullopt; // Queue is empty
+        }
+
+        T item = std::move(buffer_[current_head]);
+        head_.store((current_head + 1) & (Size - 1), std::memory_order_release);
+        return item;
+    }
+
+    // Pop up to max_items items into out in one pass
+    // Amortizes the head/tail synchronization (one acquire load and one
+    // release store per batch instead of per item); returns items popped
+    size_t pop_bulk(T* out, size_t max_items) {
+        size_t current_head = head_.load(std::memory_order_relaxed);
+        size_t current_tail = tail_.load(std::memory_order_acquire);
+
+        size_t available = (current_tail - current_head) & (Size - 1);
+        size_t count = (available < max_items) ? available : max_items;
+
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = std::move(buffer_[(current_head + i) & (Size - 1)]);
+        }
+
+        if (count > 0) {
+            head_.store((current_head + count) & (Size - 1), std::memory_order_release);
+        }
+        return count;
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) ==
+               tail_.load(std::memory_order_acquire);
+    }
+
+    size_t size() const {
+        size_t h = head_.load(std::memory_order_acquire);
+        size_t t = tail_.load(std::memory_order_acquire);
+        return (t >= h) ? (t - h) : (Size - h + t);
+    }
+
+private:
+    alignas(FALSE_SHARING_RANGE) std::atomic<size_t> head_;
+    alignas(FALSE_SHARING_RANGE) std::atomic<size_t> tail_;
+    // Keep the buffer off tail_'s cache line: without this the first few
+    // slots share a line with tail_, so consumer reads of those slots get
+    // invalidated by every producer store to tail_
+    alignas(FALSE_SHARING_RANGE) std::array<T, Size> buffer_;
+};
+
+} // namespace core
+} // namespace hft
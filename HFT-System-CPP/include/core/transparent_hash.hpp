@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string_view>
+#include <functional>
+
+namespace hft {
+namespace core {
+
+/**
+ * Transparent string hash for heterogeneous unordered_map lookups
+ * Allows find() by string_view or char* without constructing a
+ * temporary std::string key
+ */
+struct TransparentStringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view s) const {
+        return std::hash<std::string_view>{}(s);
+    }
+};
+
+} // namespace core
+} // namespace hft
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "market_making_strategy.hpp"
+#include "stat_arb_strategy.hpp"
+#include <variant>
+
+namespace hft {
+namespace strategy {
+
+/**
+ * Variant-based strategy dispatch
+ * Holding concrete strategies in a std::variant lets the per-tick
+ * onMarketData call compile to a jump table with full inlining,
+ * avoiding the vtable indirection of StrategyBase* on the hot path.
+ * StrategyBase remains the extension interface; add new concrete
+ * strategies to this variant to keep them on the fast path.
+ */
+using AnyStrategy = std::variant<MarketMakingStrategy, StatArbStrategy>;
+
+} // namespace strategy
+} // namespace hft
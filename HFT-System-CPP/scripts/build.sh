@@ -1,18 +1,18 @@
-#!/bin/bash
-
-set -e
-
-echo "Building HFT System..."
-
-# Create build directory
-mkdir -p build
-cd build
-
-# Configure with CMake
-cmake -DCMAKE_BUILD_TYPE=Release ..
-
-# Build
-make -j$(nproc)
-
-echo "Build completed successfully!"
-echo "Executable: build/hft_system"
+#!/bin/bash
+
+set -e
+
+echo "Building HFT System..."
+
+# Create build directory
+mkdir -p build
+cd build
+
+# Configure with CMake
+cmake -DCMAKE_BUILD_TYPE=Release ..
+
+# Build
+make -j$(nproc)
+
+echo "Build completed successfully!"
+echo "Executable: build/hft_system"
@@ -1,79 +1,79 @@
-#include "core/config.hpp"
-#include <fstream>
-#include <sstream>
-#include <algorithm>
-
-namespace hft {
-namespace core {
-
-void Config::load(const std::string& config_file) {
-    std::ifstream file(config_file);
-    if (!file.is_open()) {
-        throw std::runtime_error("Failed to open config file: " + config_file);
-    }
-
-    std::string line;
-    while (std::getline(file, line)) {
-        // Skip empty lines and comments
-        if (line.empty() || line[0] == '#') {
-            continue;
-        }
-
-        // Parse key=value format
-        size_t pos = line.find('=');
-        if (pos != std::string::npos) {
-            std::string key = line.substr(0, pos);
-            std::string value = line.substr(pos + 1);
-
-            // Trim whitespace
-            key.erase(0, key.find_first_not_of(" \t"));
-            key.erase(key.find_last_not_of(" \t") + 1);
-            value.erase(0, value.find_first_not_of(" \t"));
-            value.erase(value.find_last_not_of(" \t") + 1);
-
-            config_map_[key] = value;
-        }
-    }
-}
-
-std::string Config::getString(const std::string& key, const std::string& default_val) const {
-    auto it = config_map_.find(key);
-    return (it != config_map_.end()) ? it->second : default_val;
-}
-
-int Config::getInt(const std::string& key, int default_val) const {
-    auto it = config_map_.find(key);
-    if (it != config_map_.end()) {
-        try {
-            return std::stoi(it->second);
-        } catch (...) {
-            return default_val;
-        }
-    }
-    return default_val;
-}
-
-double Config::getDouble(const std::string& key, double default_val) const {
-    auto it = config_map_.find(key);
-    if (it != config_map_.end()) {
-        try {
-            return std::stod(it->second);
-        } catch (...) {
-            return default_val;
-        }
-    }
-    return default_val;
-}
-
-bool Config::getBool(const std::string& key, bool default_val) const {
-    auto it = config_map_.find(key);
-    if (it != config_map_.end()) {
-        std::string val = it->second;
-        std::transform(val.begin(), val.end(), val.begin(), ::tolower);
-        return (val == "true" || val == "1" || val == "yes");
-    }
-    return default_val;
-}
-
-} // namespace core
-} // namespace hft
+#include "core/config.hpp"
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+namespace hft {
+namespace core {
+
+void Config::load(const std::string& config_file) {
+    std::ifstream file(config_file);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open config file: " + config_file);
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        // Skip empty lines and comments
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        // Parse key=value format
+        size_t pos = line.find('=');
+        if (pos != std::string::npos) {
+            std::string key = line.substr(0, pos);
+            std::string value = line.substr(pos + 1);
+
+            // Trim whitespace
+            key.erase(0, key.find_first_not_of(" \t"));
+            key.erase(key.find_last_not_of(" \t") + 1);
+            value.erase(0, value.find_first_not_of(" \t"));
+            value.erase(value.find_last_not_of(" \t") + 1);
+
+            config_map_[key] = value;
+        }
+    }
+}
+
+std::string Config::getString(std::string_view key, std::string_view default_val) const {
+    auto it = config_map_.find(key);
+    return (it != config_map_.end()) ? it->second : std::string(default_val);
+}
+
+int Config::getInt(std::string_view key, int default_val) const {
+    auto it = config_map_.find(key);
+    if (it != config_map_.end()) {
+        try {
+            return std::stoi(it->second);
+        } catch (...) {
+            return default_val;
+        }
+    }
+    return default_val;
+}
+
+double Config::getDouble(std::string_view key, double default_val) const {
+    auto it = config_map_.find(key);
+    if (it != config_map_.end()) {
+        try {
+            return std::stod(it->second);
+        } catch (...) {
+            return default_val;
+        }
+    }
+    return default_val;
+}
+
+bool Config::getBool(std::string_view key, bool default_val) const {
+    auto it = config_map_.find(key);
+    if (it != config_map_.end()) {
+        std::string val = it->second;
+        std::transform(val.begin(), val.end(), val.begin(), ::tolower);
+        return (val == "true" || val == "1" || val == "yes");
+    }
+    return default_val;
+}
+
+} // namespace core
+} // namespace hft
@@ -1,2 +1,2 @@
-// Memory pool is header-only, this file ensures it's included in the build
-#include "core/memory_pool.hpp"
+// Memory pool is header-only, this file ensures it's included in the build
+#include "core/memory_pool.hpp"
@@ -1,10 +1,10 @@
-#include "core/timer.hpp"
-
-namespace hft {
-namespace core {
-
-// Timer implementations are header-only
-// This file ensures the timer is included in the build
-
-} // namespace core
-} // namespace hft
+#include "core/timer.hpp"
+
+namespace hft {
+namespace core {
+
+// Timer implementations are header-only
+// This file ensures the timer is included in the build
+
+} // namespace core
+} // namespace hft
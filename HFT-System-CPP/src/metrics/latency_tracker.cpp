@@ -1,10 +1,10 @@
-// Latency tracker is header-only template class
-#include "metrics/latency_tracker.hpp"
-
-namespace hft {
-namespace metrics {
-
-// Template instantiations if needed
-
-} // namespace metrics
-} // namespace hft
+// Latency tracker is header-only template class
+#include "metrics/latency_tracker.hpp"
+
+namespace hft {
+namespace metrics {
+
+// Template instantiations if needed
+
+} // namespace metrics
+} // namespace hft
@@ -1,9 +1,9 @@
-#include "strategy/strategy_base.hpp"
-
-namespace hft {
-namespace strategy {
-
-// Base class implementation (mostly virtual)
-
-} // namespace strategy
-} // namespace hft
+#include "strategy/strategy_base.hpp"
+
+namespace hft {
+namespace strategy {
+
+// Base class implementation (mostly virtual)
+
+} // namespace strategy
+} // namespace hft
@@ -1,121 +1,231 @@
-#include "../include/core/lock_free_queue.hpp"
-#include "../include/core/timer.hpp"
-#include <iostream>
-#include <thread>
-#include <cassert>
-
-using namespace hft;
-
-void testBasicOperations() {
-    std::cout << "Testing basic queue operations...\n";
-
-    core::LockFreeQueue<int, 1024> queue;
-
-    assert(queue.empty());
-    std::cout << "✓ Queue starts empty\n";
-
-    // Push items
-    for (int i = 0; i < 10; ++i) {
-        assert(queue.push(i));
-    }
-
-    assert(!queue.empty());
-    assert(queue.size() == 10);
-    std::cout << "✓ Push operations work correctly\n";
-
-    // Pop items
-    for (int i = 0; i < 10; ++i) {
-        auto item = queue.pop();
-        assert(item.has_value());
-        assert(item.value() == i);
-    }
-
-    assert(queue.empty());
-    std::cout << "✓ Pop operations work correctly\n";
-}
-
-void testThreadSafety() {
-    std::cout << "\nTesting thread safety...\n";
-
-    core::LockFreeQueue<int, 65536> queue;
-    const int num_items = 10000;
-
-    std::atomic<int> items_received{0};
-
-    // Producer thread
-    std::thread producer([&queue, num_items]() {
-        for (int i = 0; i < num_items; ++i) {
-            while (!queue.push(i)) {
-                std::this_thread::yield();
-            }
-        }
-    });
-
-    // Consumer thread
-    std::thread consumer([&queue, &items_received, num_items]() {
-        int expected = 0;
-        while (expected < num_items) {
-            auto item = queue.pop();
-            if (item.has_value()) {
-                assert(item.value() == expected);
-                expected++;
-                items_received++;
-            } else {
-                std::this_thread::yield();
-            }
-        }
-    });
-
-    producer.join();
-    consumer.join();
-
-    assert(items_received == num_items);
-    std::cout << "✓ Thread safety verified\n";
-}
-
-void testPerformance() {
-    std::cout << "\nTesting queue performance...\n";
-
-    core::LockFreeQueue<int, 65536> queue;
-    const int num_items = 100000;
-
-    core::Timer timer;
-
-    // Push
-    for (int i = 0; i < num_items; ++i) {
-        queue.push(i);
-    }
-
-    int64_t push_time = timer.elapsed_us();
-
-    timer.reset();
-
-    // Pop
-    for (int i = 0; i < num_items; ++i) {
-        queue.pop();
-    }
-
-    int64_t pop_time = timer.elapsed_us();
-
-    std::cout << "  Push " << num_items << " items: " << push_time << " us\n";
-    std::cout << "  Pop " << num_items << " items: " << pop_time << " us\n";
-    std::cout << "  Avg push latency: " << (double)push_time / num_items << " us\n";
-    std::cout << "  Avg pop latency: " << (double)pop_time / num_items << " us\n";
-    std::cout << "✓ Performance test completed\n";
-}
-
-int main() {
-    std::cout << "=== Lock-Free Queue Tests ===\n\n";
-
-    try {
-        testBasicOperations();
-        testThreadSafety();
-        testPerformance();
-
-        std::cout << "\n✅ All tests passed!\n";
-        return 0;
-    } catch (const std::exception& e) {
-        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
-        return 1;
-    }
-}
+#include "../include/core/lock_free_queue.hpp"
+#include "../include/core/timer.hpp"
+#include <iostream>
+#include <thread>
+#include <cassert>
+
+using namespace hft;
+
+void testBasicOperations() {
+    std::cout << "Testing basic queue operations...\n";
+
+    core::LockFreeQueue<int, 1024> queue;
+
+    assert(queue.empty());
+    std::cout << "✓ Queue starts empty\n";
+
+    // Push items
+    for (int i = 0; i < 10; ++i) {
+        assert(queue.push(i));
+    }
+
+    assert(!queue.empty());
+    assert(queue.size() == 10);
+    std::cout << "✓ Push operations work correctly\n";
+
+    // Pop items
+    for (int i = 0; i < 10; ++i) {
+        auto item = queue.pop();
+        assert(item.has_value());
+        assert(item.value() == i);
+    }
+
+    assert(queue.empty());
+    std::cout << "✓ Pop operations work correctly\n";
+}
+
+void testBulkPop() {
+    std::cout << "\nTesting bulk pop...\n";
+
+    core::LockFreeQueue<int, 16> queue;
+    int out[16];
+
+    // Bulk pop of an empty queue returns nothing
+    assert(queue.pop_bulk(out, 16) == 0);
+    std::cout << "✓ Bulk pop on empty queue returns 0\n";
+
+    // Partially filled queue: asking for more than available drains it
+    for (int i = 0; i < 5; ++i) {
+        assert(queue.push(i));
+    }
+    size_t count = queue.pop_bulk(out, 16);
+    assert(count == 5);
+    for (int i = 0; i < 5; ++i) {
+        assert(out[i] == i);
+    }
+    assert(queue.empty());
+    std::cout << "✓ Bulk pop drains a partially filled queue\n";
+
+    // max_items smaller than available leaves the remainder queued
+    for (int i = 0; i < 10; ++i) {
+        assert(queue.push(i));
+    }
+    count = queue.pop_bulk(out, 4);
+    assert(count == 4);
+    for (int i = 0; i < 4; ++i) {
+        assert(out[i] == i);
+    }
+    assert(queue.size() == 6);
+    count = queue.pop_bulk(out, 16);
+    assert(count == 6);
+    for (int i = 0; i < 6; ++i) {
+        assert(out[i] == i + 4);
+    }
+    std::cout << "✓ Bulk pop respects max_items\n";
+}
+
+void testBulkPopWrapped() {
+    std::cout << "\nTesting bulk pop across ring wraparound...\n";
+
+    core::LockFreeQueue<int, 16> queue;
+    int out[16];
+
+    // Advance head near the end of the ring, then refill so the live
+    // region wraps (head > tail) and the copy loop must mask indices
+    for (int i = 0; i < 12; ++i) {
+        assert(queue.push(i));
+    }
+    assert(queue.pop_bulk(out, 12) == 12);
+
+    for (int i = 100; i < 110; ++i) {
+        assert(queue.push(i));
+    }
+    size_t count = queue.pop_bulk(out, 16);
+    assert(count == 10);
+    for (int i = 0; i < 10; ++i) {
+        assert(out[i] == 100 + i);
+    }
+    assert(queue.empty());
+    std::cout << "✓ Bulk pop handles wrapped head/tail\n";
+}
+
+void testBulkThreadSafety() {
+    std::cout << "\nTesting bulk pop thread safety...\n";
+
+    core::LockFreeQueue<int, 65536> queue;
+    const int num_items = 10000;
+
+    std::atomic<int> items_received{0};
+
+    // Producer thread
+    std::thread producer([&queue, num_items]() {
+        for (int i = 0; i < num_items; ++i) {
+            while (!queue.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // Consumer thread draining in batches
+    std::thread consumer([&queue, &items_received, num_items]() {
+        int batch[64];
+        int expected = 0;
+        while (expected < num_items) {
+            size_t count = queue.pop_bulk(batch, 64);
+            if (count > 0) {
+                for (size_t i = 0; i < count; ++i) {
+                    assert(batch[i] == expected);
+                    expected++;
+                    items_received++;
+                }
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    assert(items_received == num_items);
+    std::cout << "✓ Bulk pop thread safety verified\n";
+}
+
+void testThreadSafety() {
+    std::cout << "\nTesting thread safety...\n";
+
+    core::LockFreeQueue<int, 65536> queue;
+    const int num_items = 10000;
+
+    std::atomic<int> items_received{0};
+
+    // Producer thread
+    std::thread producer([&queue, num_items]() {
+        for (int i = 0; i < num_items; ++i) {
+            while (!queue.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // Consumer thread
+    std::thread consumer([&queue, &items_received, num_items]() {
+        int expected = 0;
+        while (expected < num_items) {
+            auto item = queue.pop();
+            if (item.has_value()) {
+                assert(item.value() == expected);
+                expected++;
+                items_received++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    assert(items_received == num_items);
+    std::cout << "✓ Thread safety verified\n";
+}
+
+void testPerformance() {
+    std::cout << "\nTesting queue performance...\n";
+
+    core::LockFreeQueue<int, 65536> queue;
+    const int num_items = 100000;
+
+    core::Timer timer;
+
+    // Push
+    for (int i = 0; i < num_items; ++i) {
+        queue.push(i);
+    }
+
+    int64_t push_time = timer.elapsed_us();
+
+    timer.reset();
+
+    // Pop
+    for (int i = 0; i < num_items; ++i) {
+        queue.pop();
+    }
+
+    int64_t pop_time = timer.elapsed_us();
+
+    std::cout << "  Push " << num_items << " items: " << push_time << " us\n";
+    std::cout << "  Pop " << num_items << " items: " << pop_time << " us\n";
+    std::cout << "  Avg push latency: " << (double)push_time / num_items << " us\n";
+    std::cout << "  Avg pop latency: " << (double)pop_time / num_items << " us\n";
+    std::cout << "✓ Performance test completed\n";
+}
+
+int main() {
+    std::cout << "=== Lock-Free Queue Tests ===\n\n";
+
+    try {
+        testBasicOperations();
+        testBulkPop();
+        testBulkPopWrapped();
+        testThreadSafety();
+        testBulkThreadSafety();
+        testPerformance();
+
+        std::cout << "\n✅ All tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,102 @@
+#include "../include/oms/position_manager.hpp"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+
+using namespace hft;
+
+namespace {
+bool near(double a, double b) {
+    return std::abs(a - b) < 1e-9;
+}
+}
+
+void testOpenAndSameSideAdd() {
+    std::cout << "Testing open from flat and same-side add...\n";
+
+    oms::PositionManager pm;
+
+    pm.updatePosition("AAPL", 100, 10.0, 1);
+    assert(pm.getNetPosition("AAPL") == 100);
+    assert(near(pm.getPosition("AAPL")->average_price, 10.0));
+    assert(near(pm.getRealizedPnL("AAPL"), 0.0));
+    std::cout << "✓ Opening from flat sets entry price\n";
+
+    // Same-side add: volume-weighted average, no realized PnL
+    pm.updatePosition("AAPL", 100, 20.0, 2);
+    assert(pm.getNetPosition("AAPL") == 200);
+    assert(near(pm.getPosition("AAPL")->average_price, 15.0));
+    assert(near(pm.getRealizedPnL("AAPL"), 0.0));
+    std::cout << "✓ Same-side add blends average price\n";
+}
+
+void testPartialReduceAndFullClose() {
+    std::cout << "\nTesting partial reduce and full close...\n";
+
+    oms::PositionManager pm;
+    pm.updatePosition("AAPL", 200, 15.0, 1);
+
+    // Partial reduce: realizes PnL on the closed quantity, keeps entry price
+    pm.updatePosition("AAPL", -50, 25.0, 2);
+    assert(pm.getNetPosition("AAPL") == 150);
+    assert(near(pm.getPosition("AAPL")->average_price, 15.0));
+    assert(near(pm.getRealizedPnL("AAPL"), 500.0));  // (25 - 15) * 50
+    std::cout << "✓ Partial reduce realizes closed quantity only\n";
+
+    // Full close: realizes the rest and resets the entry price
+    pm.updatePosition("AAPL", -150, 20.0, 3);
+    assert(pm.getNetPosition("AAPL") == 0);
+    assert(near(pm.getPosition("AAPL")->average_price, 0.0));
+    assert(near(pm.getRealizedPnL("AAPL"), 1250.0));  // 500 + (20 - 15) * 150
+    assert(near(pm.getUnrealizedPnL("AAPL", 30.0), 0.0));
+    std::cout << "✓ Full close realizes remainder and clears entry price\n";
+}
+
+void testFlipThroughZero() {
+    std::cout << "\nTesting flip through zero...\n";
+
+    oms::PositionManager pm;
+    pm.updatePosition("AAPL", 100, 10.0, 1);
+
+    // Long 100 @ 10, sell 150 @ 12: closes the 100 for +200 realized and
+    // opens a 50-lot short whose entry price is the flip price, not the
+    // stale long entry
+    pm.updatePosition("AAPL", -150, 12.0, 2);
+    assert(pm.getNetPosition("AAPL") == -50);
+    assert(near(pm.getRealizedPnL("AAPL"), 200.0));  // (12 - 10) * 100
+    assert(near(pm.getPosition("AAPL")->average_price, 12.0));
+    assert(near(pm.getUnrealizedPnL("AAPL", 12.0), 0.0));
+    std::cout << "✓ Flip through zero re-bases entry at the flip price\n";
+}
+
+void testShortSide() {
+    std::cout << "\nTesting short-side accounting...\n";
+
+    oms::PositionManager pm;
+
+    // Short 100 @ 50, buy back 40 @ 45: profit on the covered quantity
+    pm.updatePosition("AAPL", -100, 50.0, 1);
+    pm.updatePosition("AAPL", 40, 45.0, 2);
+    assert(pm.getNetPosition("AAPL") == -60);
+    assert(near(pm.getPosition("AAPL")->average_price, 50.0));
+    assert(near(pm.getRealizedPnL("AAPL"), 200.0));  // (45 - 50) * -1 * 40
+    assert(near(pm.getUnrealizedPnL("AAPL", 48.0), 120.0));  // (48 - 50) * -60
+    std::cout << "✓ Short cover realizes inverted price difference\n";
+}
+
+int main() {
+    std::cout << "=== Position Manager Tests ===\n\n";
+
+    try {
+        testOpenAndSameSideAdd();
+        testPartialReduceAndFullClose();
+        testFlipThroughZero();
+        testShortSide();
+
+        std::cout << "\n✅ All tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
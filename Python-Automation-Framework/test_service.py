@@ -1,5 +1,5 @@
-import requests
-def test_health():
-    r=requests.get("http://<ec2-ip>/health")
-    assert r.status_code==200
+import requests
+def test_health():
+    r=requests.get("http://<ec2-ip>/health")
+    assert r.status_code==200
     print("Health check passed")
\ No newline at end of file